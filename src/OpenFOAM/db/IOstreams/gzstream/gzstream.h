@@ -95,6 +95,7 @@ public:
    }
    gzstreambuf* open( const char* name, int open_mode );
    gzstreambuf* close();
+   int          setLevel( int level );
    virtual int     overflow( int c = EOF );
    virtual int     underflow();
    virtual int     sync();